@@ -0,0 +1,158 @@
+/**
+ * @file arena.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Implementation of the linear arena used for level-scoped memory.
+ * This file contains the definitions of functions declared in arena.h,
+ * handling block allocation, arena-backed image loading and level teardown.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <SDL/SDL.h>
+#include <SDL/SDL_image.h>
+#include "arena.h"
+
+// Reserve the memory block backing the arena
+/**
+ * @brief Reserves the memory block backing the arena.
+ * @param a Pointer to the Arena structure to initialize.
+ * @param capacite Size of the block in bytes.
+ * @return 0 on success, -1 if the block could not be allocated.
+ */
+int initArena(Arena *a, size_t capacite)
+{
+    a->base = malloc(capacite);
+    a->capacite = (a->base != NULL) ? capacite : 0;
+    a->offset = 0;
+    a->pic = 0;
+    a->nbSurfaces = 0;
+    if (a->base == NULL)
+    {
+        printf("Unable to reserve %lu bytes for the level arena\n", (unsigned long)capacite);
+        return -1;
+    }
+    return 0;
+}
+
+// Bump-allocate a zeroed block from the arena
+/**
+ * @brief Allocates a zeroed block from the arena.
+ * @param a Pointer to the Arena to allocate from.
+ * @param taille Number of bytes requested.
+ * @return Pointer to the block, or NULL if the arena is full.
+ */
+void *arenaAlloc(Arena *a, size_t taille)
+{
+    size_t debut = (a->offset + ARENA_ALIGNEMENT - 1) & ~(size_t)(ARENA_ALIGNEMENT - 1);
+    if (debut > a->capacite || taille > a->capacite - debut)
+    {
+        printf("Level arena exhausted: %lu bytes requested, %lu left\n",
+               (unsigned long)taille, (unsigned long)(a->capacite - a->offset));
+        return NULL;
+    }
+    a->offset = debut + taille;
+    if (a->offset > a->pic)
+        a->pic = a->offset;
+    memset(a->base + debut, 0, taille);
+    return a->base + debut;
+}
+
+// Decode an image and copy its pixels into the arena
+/**
+ * @brief Loads an image whose pixels are stored in the arena.
+ * @param a Pointer to the Arena that owns the pixels.
+ * @param url File path of the image.
+ * @return The surface, or NULL on failure.
+ */
+SDL_Surface *arenaChargerImage(Arena *a, const char *url)
+{
+    SDL_Surface *tmp, *surface;
+    Uint32 rmask = 0x00FF0000, gmask = 0x0000FF00, bmask = 0x000000FF, amask = 0;
+    int pitch;
+    void *pixels;
+
+    if (a->nbSurfaces >= ARENA_MAX_SURFACES)
+    {
+        printf("Too many surfaces in the level arena, cannot load %s\n", url);
+        return NULL;
+    }
+
+    tmp = IMG_Load(url);
+    if (tmp == NULL)
+    {
+        printf("unable to load image %s : %s\n", url, SDL_GetError());
+        return NULL;
+    }
+
+    if (tmp->format->BitsPerPixel == 32)
+    {
+        rmask = tmp->format->Rmask;
+        gmask = tmp->format->Gmask;
+        bmask = tmp->format->Bmask;
+        amask = tmp->format->Amask;
+    }
+
+    pitch = tmp->w * 4;
+    pixels = arenaAlloc(a, (size_t)pitch * tmp->h);
+    if (pixels == NULL)
+    {
+        SDL_FreeSurface(tmp);
+        return NULL;
+    }
+
+    // SDL does not free pixels passed to SDL_CreateRGBSurfaceFrom, so they stay owned by the arena
+    surface = SDL_CreateRGBSurfaceFrom(pixels, tmp->w, tmp->h, 32, pitch, rmask, gmask, bmask, amask);
+    if (surface == NULL)
+    {
+        printf("unable to create arena surface for %s : %s\n", url, SDL_GetError());
+        SDL_FreeSurface(tmp);
+        return NULL;
+    }
+
+    // Plain copy, alpha channel included
+    SDL_SetAlpha(tmp, 0, 255);
+    SDL_BlitSurface(tmp, NULL, surface, NULL);
+    SDL_FreeSurface(tmp);
+
+    a->surfaces[a->nbSurfaces++] = surface;
+    return surface;
+}
+
+// Report the high-water mark, used to check that level loads do not grow
+/**
+ * @brief Returns the highest offset the arena has reached since initialisation.
+ * @param a Pointer to the Arena to query.
+ * @return The high-water mark, in bytes.
+ */
+size_t arenaPic(const Arena *a)
+{
+    return a->pic;
+}
+
+// Release everything the current level allocated
+/**
+ * @brief Releases everything allocated since the last reset.
+ * @param a Pointer to the Arena to reset.
+ */
+void arenaReset(Arena *a)
+{
+    int i;
+    for (i = 0; i < a->nbSurfaces; i++)
+        SDL_FreeSurface(a->surfaces[i]);
+    a->nbSurfaces = 0;
+    a->offset = 0;
+}
+
+// Reset the arena and give its block back to the system
+/**
+ * @brief Resets the arena and returns its memory block to the system.
+ * @param a Pointer to the Arena to free.
+ */
+void libererArena(Arena *a)
+{
+    arenaReset(a);
+    free(a->base);
+    a->base = NULL;
+    a->capacite = 0;
+}
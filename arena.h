@@ -0,0 +1,77 @@
+/**
+ * @file arena.h
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Header file defining the linear arena used for level-scoped memory.
+ * Everything a level owns (entity arrays, spawn tables, decoded sprite pixels and
+ * scratch buffers) is carved out of one arena, so a level is torn down with a single
+ * arenaReset() instead of a trail of free()/SDL_FreeSurface() calls.
+ */
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <stddef.h>
+#include <SDL/SDL.h>
+
+/** @brief Alignment of every block returned by arenaAlloc(). */
+#define ARENA_ALIGNEMENT 16
+
+/** @brief Maximum number of surfaces a single level can load through the arena. */
+#define ARENA_MAX_SURFACES 32
+
+/**
+ * @brief Structure representing a linear (bump) allocator.
+ */
+typedef struct
+{
+  unsigned char *base;                        /**< Start of the reserved memory block */
+  size_t capacite;                            /**< Size of the block in bytes */
+  size_t offset;                              /**< Next free byte in the block */
+  size_t pic;                                 /**< Highest offset reached since initialisation */
+  SDL_Surface *surfaces[ARENA_MAX_SURFACES];  /**< Surface headers whose pixels live in the arena */
+  int nbSurfaces;                             /**< Number of entries used in surfaces */
+} Arena;
+
+/**
+ * @brief Reserves the memory block backing the arena.
+ * @param a Pointer to the Arena structure to initialize.
+ * @param capacite Size of the block in bytes.
+ * @return 0 on success, -1 if the block could not be allocated.
+ */
+int initArena(Arena *a, size_t capacite);
+/**
+ * @brief Allocates a zeroed block from the arena.
+ * @param a Pointer to the Arena to allocate from.
+ * @param taille Number of bytes requested.
+ * @return Pointer to the block, or NULL if the arena is full.
+ */
+void *arenaAlloc(Arena *a, size_t taille);
+/**
+ * @brief Loads an image whose pixels are stored in the arena.
+ * The decoded image is copied into arena memory and the temporary surface is freed,
+ * so only a small surface header stays outside the arena until the next reset.
+ * @param a Pointer to the Arena that owns the pixels.
+ * @param url File path of the image.
+ * @return The surface, or NULL on failure.
+ */
+SDL_Surface *arenaChargerImage(Arena *a, const char *url);
+/**
+ * @brief Returns the highest offset the arena has reached since initialisation.
+ * Repeated level loads should leave this value flat after the first one.
+ * @param a Pointer to the Arena to query.
+ * @return The high-water mark, in bytes.
+ */
+size_t arenaPic(const Arena *a);
+/**
+ * @brief Releases everything allocated since the last reset.
+ * Every pointer and surface obtained from the arena becomes invalid.
+ * @param a Pointer to the Arena to reset.
+ */
+void arenaReset(Arena *a);
+/**
+ * @brief Resets the arena and returns its memory block to the system.
+ * @param a Pointer to the Arena to free.
+ */
+void libererArena(Arena *a);
+
+#endif
@@ -50,8 +50,9 @@ void afficher_imageBMP(SDL_Surface *screen, image image)
 /**
  * @brief Initializes the enemy (bat) for Level 1.
  * @param e Pointer to the Ennemi structure to initialize.
+ * @param niveau Arena of the current level, owning the spritesheet.
  */
-void initEnnemi(Ennemi *e)
+void initEnnemi(Ennemi *e, Arena *niveau)
 {
     e->pos_depart.x = 260;
     e->pos_depart.y = 100;
@@ -60,8 +61,9 @@ void initEnnemi(Ennemi *e)
     e->vitesse = 0;
     e->alive = 1;
     e->health = 50;
+    e->ticksEnAttente = 0;
 
-    e->spritesheet = IMG_Load("batt.png");
+    e->spritesheet = arenaChargerImage(niveau, "batt.png");
     if (e->spritesheet == NULL)
     {
         printf("Erreur lors du chargement de la spritesheet de l'ennemi : %s\n", SDL_GetError());
@@ -83,8 +85,9 @@ void initEnnemi(Ennemi *e)
 /**
  * @brief Initializes the enemy for Level 2.
  * @param e Pointer to the Ennemi structure to initialize.
+ * @param niveau Arena of the current level, owning the spritesheet.
  */
-void initEnnemiLevel2(Ennemi *e) {
+void initEnnemiLevel2(Ennemi *e, Arena *niveau) {
     e->pos_depart.x = 500;
     e->pos_depart.y = 500;
     e->pos_actuelle = e->pos_depart;
@@ -92,15 +95,16 @@ void initEnnemiLevel2(Ennemi *e) {
     e->vitesse = 0;
     e->alive = 1;
     e->health = 70;
+    e->ticksEnAttente = 0;
 
-    e->spritesheet = IMG_Load("ennemi.png");
+    // A missing spritesheet must not leave the enemy half-initialised
+    e->spritesheet = arenaChargerImage(niveau, "ennemi.png");
     if (e->spritesheet == NULL) {
         printf("Erreur lors du chargement de la spritesheet de l'ennemi : %s\n", SDL_GetError());
-        return;
+    } else {
+        SDL_SetColorKey(e->spritesheet, SDL_SRCCOLORKEY, SDL_MapRGB(e->spritesheet->format, 0, 0, 0));
     }
 
-    SDL_SetColorKey(e->spritesheet, SDL_SRCCOLORKEY, SDL_MapRGB(e->spritesheet->format, 0, 0, 0));
-
     e->frame = 0;
     e->frameCount = 4;
     e->frameWidth = 64;
@@ -128,7 +132,9 @@ void afficherEnnemi(Ennemi *e, SDL_Surface *screen)
     SDL_SetAlpha(e->spritesheet, 0, 255);
     SDL_SetColorKey(e->spritesheet, SDL_SRCCOLORKEY, SDL_MapRGB(e->spritesheet->format, 0, 0, 0));
 
-    SDL_BlitSurface(e->spritesheet, &e->pos_sprites, screen, &e->pos_depart);
+    // Blit a copy: SDL clips the rect in place, which would snap an enemy at x < 0 back to 0
+    SDL_Rect dst = e->pos_depart;
+    SDL_BlitSurface(e->spritesheet, &e->pos_sprites, screen, &dst);
 }
 
 // Animate the enemy based on its state
@@ -170,6 +176,37 @@ void move(Ennemi *e)
         e->pos_depart.y -= 7;
 }
 
+// Apply n vertical steps at once, jumping from one bounce to the next
+/**
+ * @brief Moves the Level 1 enemy vertically as if move() had been called n times.
+ * @param e Pointer to the Ennemi structure to move.
+ * @param n Number of steps to apply.
+ */
+void moveN(Ennemi *e, int n)
+{
+    int y, pas;
+    while (n > 0)
+    {
+        y = e->pos_depart.y;
+        if (y < 12)
+            e->direction = 1;
+        else if (y > 400)
+            e->direction = 0;
+
+        if (e->direction == 1)
+            pas = (400 - y) / 7 + 1;
+        else if (e->direction == 0)
+            pas = (y - 12) / 7 + 1;
+        else
+            return;
+        if (pas > n)
+            pas = n;
+
+        e->pos_depart.y += (e->direction == 1 ? 7 : -7) * pas;
+        n -= pas;
+    }
+}
+
 // Make the Level 1 enemy follow the player
 /**
  * @brief Makes the Level 1 enemy follow the player.
@@ -277,6 +314,57 @@ void moveIALevel2(Ennemi *e, SDL_Rect posperso) {
     moveEnnemiLevel2(e, posperso);
 }
 
+// Check whether the enemy's sprite overlaps the camera
+/**
+ * @brief Checks whether the enemy's sprite overlaps the camera.
+ * @param e Pointer to the Ennemi structure to test.
+ * @param camera SDL_Rect representing the visible part of the world.
+ * @return 1 if the enemy is on screen, 0 otherwise.
+ */
+int ennemiVisible(Ennemi *e, SDL_Rect camera)
+{
+    return e->pos_depart.x + e->frameWidth > camera.x &&
+           e->pos_depart.x < camera.x + camera.w &&
+           e->pos_depart.y + e->frameHeight > camera.y &&
+           e->pos_depart.y < camera.y + camera.h;
+}
+
+// Run the enemy's AI, at a reduced rate when it is off screen, idle and far from the player
+/**
+ * @brief Runs the enemy's AI for one frame with distance-based level of detail.
+ * @param e Pointer to the Ennemi structure to update.
+ * @param posperso SDL_Rect representing the player's position.
+ * @param level Current level (1 or 2), selecting the AI to run.
+ * @param visible Result of ennemiVisible() for this frame; visible enemies are never deferred.
+ * @param stats Counters updated with the work done or deferred.
+ */
+void mettreAJourIA(Ennemi *e, SDL_Rect posperso, int level, int visible, CullStats *stats)
+{
+    int dx = abs(e->pos_depart.x - posperso.x);
+    int dy = abs(e->pos_depart.y - posperso.y);
+
+    e->ticksEnAttente++;
+    // Beyond IA_LOD_DISTANCE neither side can close the gap to the WAITING threshold
+    // within IA_LOD_INTERVALLE frames, so the state cannot change while deferred
+    if (!visible && e->state == WAITING && dx > IA_LOD_DISTANCE && dy > IA_LOD_DISTANCE &&
+        e->ticksEnAttente < IA_LOD_INTERVALLE)
+    {
+        stats->iaReportees++;
+        return;
+    }
+
+    if (level == 1) {
+        if (e->state == WAITING)
+            moveN(e, e->ticksEnAttente - 1);
+        moveIA(e, posperso);
+    } else {
+        // A WAITING Level 2 enemy stands still, a single update is enough to catch up
+        moveIALevel2(e, posperso);
+    }
+    e->ticksEnAttente = 0;
+    stats->iaExecutees++;
+}
+
 // Check for collision using circular approximation
 /**
  * @brief Checks for collision between an enemy and the player using circular approximation.
@@ -312,3 +400,79 @@ int collisionTri(Ennemi *e, SDL_Rect posPerso) {
     }
     return estcoli;
 }
+
+// Create the fallback coin image, a gold square
+/**
+ * @brief Initializes a coin with a simple gold square appearance.
+ * @param coin Pointer to the Coin structure to initialize.
+ */
+void initCoin(Coin *coin) {
+    coin->img = SDL_CreateRGBSurface(SDL_SWSURFACE, 20, 20, 32, 0, 0, 0, 0);
+    if (coin->img == NULL) {
+        printf("Failed to create fallback coin surface: %s\n", SDL_GetError());
+        return;
+    }
+    SDL_FillRect(coin->img, NULL, SDL_MapRGB(coin->img->format, 255, 215, 0));
+    SDL_SetColorKey(coin->img, SDL_SRCCOLORKEY, SDL_MapRGB(coin->img->format, 0, 0, 0));
+    SDL_Rect outline = {0, 0, 20, 20};
+    SDL_FillRect(coin->img, &outline, SDL_MapRGB(coin->img->format, 0, 0, 0));
+    SDL_Rect inner = {2, 2, 16, 16};
+    SDL_FillRect(coin->img, &inner, SDL_MapRGB(coin->img->format, 255, 215, 0));
+    coin->pos.w = 20;
+    coin->pos.h = 20;
+    coin->visible = 0;
+}
+
+// Display the coin on the screen if it is visible
+/**
+ * @brief Displays a coin on the screen if it is visible.
+ * @param coin Pointer to the Coin structure to display.
+ * @param screen The SDL surface to draw the coin on.
+ */
+void displayCoin(Coin *coin, SDL_Surface *screen) {
+    if (coin->visible) {
+        if (coin->img != NULL) {
+            // SDL writes the clipped size back into the rect, which must not change the hitbox
+            SDL_Rect dst = coin->pos;
+            SDL_BlitSurface(coin->img, NULL, screen, &dst);
+        } else {
+            printf("Coin image is NULL, cannot render coin at position (%d, %d)\n", coin->pos.x, coin->pos.y);
+        }
+    }
+}
+
+// Check for coin pickup using circular approximation
+/**
+ * @brief Checks for collision between a coin and the player using circular approximation.
+ * @param coin Pointer to the Coin structure to check collision with.
+ * @param posPerso SDL_Rect representing the player's position and size.
+ * @return 1 if collision detected, 0 otherwise.
+ */
+int collisionTriCoin(Coin *coin, SDL_Rect posPerso) {
+    int estcoli;
+    float R1, R2, X1, X2, D1, D2, Y1, Y2;
+    X1 = posPerso.x + posPerso.w / 2;
+    Y1 = posPerso.y + posPerso.h / 2;
+    R1 = sqrt(pow(posPerso.w / 2, 2) + pow(posPerso.h / 2, 2));
+    if (posPerso.w < posPerso.h) {
+        R1 = posPerso.w / 2;
+    } else {
+        R1 = posPerso.h / 2;
+    }
+    X2 = coin->pos.x + coin->pos.w / 2;
+    Y2 = coin->pos.y + coin->pos.h / 2;
+    R2 = sqrt(pow(coin->pos.w / 2, 2) + pow(coin->pos.h / 2, 2));
+    if (coin->pos.w < coin->pos.h) {
+        R2 = coin->pos.w / 2;
+    } else {
+        R2 = coin->pos.h / 2;
+    }
+    D1 = sqrt(pow(X2 - X1, 2) + pow(Y2 - Y1, 2));
+    D2 = R1 + R2;
+    if (D1 <= D2) {
+        estcoli = 1;
+    } else {
+        estcoli = 0;
+    }
+    return estcoli;
+}
@@ -13,6 +13,7 @@
 #include <SDL/SDL_image.h>
 #include <SDL/SDL_mixer.h>
 #include <SDL/SDL_ttf.h>
+#include "arena.h"
 
 /**
  * @brief Enumeration of possible enemy states.
@@ -25,6 +26,23 @@ enum STATE
 };
 typedef enum STATE STATE;
 
+/** @brief Distance (on both axes) beyond which a culled WAITING enemy ticks its AI at a reduced rate. */
+#define IA_LOD_DISTANCE 400
+
+/** @brief A culled, far WAITING enemy runs its AI once every IA_LOD_INTERVALLE frames. */
+#define IA_LOD_INTERVALLE 4
+
+/**
+ * @brief Per-frame counters of the work done and skipped for enemies.
+ */
+typedef struct
+{
+  int dessins;        /**< Enemies drawn and animated */
+  int dessinsEvites;  /**< Enemies skipped because they are outside the camera */
+  int iaExecutees;    /**< AI updates actually run */
+  int iaReportees;    /**< AI updates deferred by the level of detail (culled enemies only) */
+} CullStats;
+
 /**
  * @brief Structure representing an enemy entity.
  */
@@ -34,7 +52,7 @@ typedef struct
   SDL_Rect pos_actuelle;    /**< Current position of the enemy */
   int direction;            /**< Direction of movement (0 = up/left, 1 = down/right) */
   float vitesse;            /**< Speed of the enemy */
-  SDL_Surface *spritesheet; /**< Image containing all animation frames */
+  SDL_Surface *spritesheet; /**< Image containing all animation frames (owned by the level arena) */
   SDL_Rect pos_sprites;     /**< Portion of the spritesheet to display */
   int frame;                /**< Current frame of animation */
   int frameCount;           /**< Total number of frames */
@@ -43,6 +61,7 @@ typedef struct
   int alive;                /**< Flag to check if the enemy is alive */
   STATE state;              /**< Current state of the enemy */
   int health;               /**< Health points of the enemy */
+  int ticksEnAttente;       /**< AI frames elapsed since the last real update */
 } Ennemi;
 
 /**
@@ -83,13 +102,15 @@ void afficher_imageBMP(SDL_Surface *screen, image image);
 /**
  * @brief Initializes the enemy (bat) for Level 1.
  * @param e Pointer to the Ennemi structure to initialize.
+ * @param niveau Arena of the current level, owning the spritesheet.
  */
-void initEnnemi(Ennemi *e);
+void initEnnemi(Ennemi *e, Arena *niveau);
 /**
  * @brief Initializes the enemy for Level 2.
  * @param e Pointer to the Ennemi structure to initialize.
+ * @param niveau Arena of the current level, owning the spritesheet.
  */
-void initEnnemiLevel2(Ennemi *e);
+void initEnnemiLevel2(Ennemi *e, Arena *niveau);
 /**
  * @brief Displays the enemy on the screen.
  * @param e Pointer to the Ennemi structure to display.
@@ -106,6 +127,12 @@ void animerEnemi(Ennemi *e);
  * @param e Pointer to the Ennemi structure to move.
  */
 void move(Ennemi *e);
+/**
+ * @brief Moves the Level 1 enemy vertically as if move() had been called n times.
+ * @param e Pointer to the Ennemi structure to move.
+ * @param n Number of steps to apply.
+ */
+void moveN(Ennemi *e, int n);
 /**
  * @brief Makes the Level 1 enemy follow the player.
  * @param e Pointer to the Ennemi structure to move.
@@ -131,6 +158,25 @@ void moveIA(Ennemi *e, SDL_Rect posperso);
  * @param posperso SDL_Rect representing the player's position.
  */
 void moveIALevel2(Ennemi *e, SDL_Rect posperso);
+/**
+ * @brief Checks whether the enemy's sprite overlaps the camera.
+ * @param e Pointer to the Ennemi structure to test.
+ * @param camera SDL_Rect representing the visible part of the world.
+ * @return 1 if the enemy is on screen, 0 otherwise.
+ */
+int ennemiVisible(Ennemi *e, SDL_Rect camera);
+/**
+ * @brief Runs the enemy's AI for one frame with distance-based level of detail.
+ * Culled, far WAITING enemies only update every IA_LOD_INTERVALLE frames and replay
+ * the skipped patrol steps when they do, so their movement matches a per-frame update.
+ * An enemy on screen always updates, so the one the player sees never lags.
+ * @param e Pointer to the Ennemi structure to update.
+ * @param posperso SDL_Rect representing the player's position.
+ * @param level Current level (1 or 2), selecting the AI to run.
+ * @param visible Result of ennemiVisible() for this frame; visible enemies are never deferred.
+ * @param stats Counters updated with the work done or deferred.
+ */
+void mettreAJourIA(Ennemi *e, SDL_Rect posperso, int level, int visible, CullStats *stats);
 /**
  * @brief Checks for collision between an enemy and the player using circular approximation.
  * @param e Pointer to the Ennemi structure to check collision with.
@@ -139,4 +185,24 @@ void moveIALevel2(Ennemi *e, SDL_Rect posperso);
  */
 int collisionTri(Ennemi *e, SDL_Rect posPerso);
 
+// Function declarations for coin handling
+/**
+ * @brief Initializes a coin with a simple gold square appearance.
+ * @param coin Pointer to the Coin structure to initialize.
+ */
+void initCoin(Coin *coin);
+/**
+ * @brief Displays a coin on the screen if it is visible.
+ * @param coin Pointer to the Coin structure to display.
+ * @param screen The SDL surface to draw the coin on.
+ */
+void displayCoin(Coin *coin, SDL_Surface *screen);
+/**
+ * @brief Checks for collision between a coin and the player using circular approximation.
+ * @param coin Pointer to the Coin structure to check collision with.
+ * @param posPerso SDL_Rect representing the player's position and size.
+ * @return 1 if collision detected, 0 otherwise.
+ */
+int collisionTriCoin(Coin *coin, SDL_Rect posPerso);
+
 #endif
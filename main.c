@@ -8,11 +8,13 @@
  */
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <SDL/SDL.h>
 #include <SDL/SDL_ttf.h>
 #include <SDL/SDL_image.h>
 #include <SDL/SDL_mixer.h>
 #include "enemy.h"
+#include "particules.h"
 
 /**
  * @brief Draws a health bar on the screen based on the entity's health.
@@ -40,77 +42,6 @@ void draw_health_bar(SDL_Surface *screen, int health, int max_health, int x, int
     SDL_FillRect(screen, &health_rect, color);
 }
 
-/**
- * @brief Initializes a coin with a simple gold square appearance.
- * @param coin Pointer to the Coin structure to initialize.
- */
-void initCoin(Coin *coin) {
-    coin->img = SDL_CreateRGBSurface(SDL_SWSURFACE, 20, 20, 32, 0, 0, 0, 0);
-    if (coin->img == NULL) {
-        printf("Failed to create fallback coin surface: %s\n", SDL_GetError());
-        return;
-    }
-    SDL_FillRect(coin->img, NULL, SDL_MapRGB(coin->img->format, 255, 215, 0));
-    SDL_SetColorKey(coin->img, SDL_SRCCOLORKEY, SDL_MapRGB(coin->img->format, 0, 0, 0));
-    SDL_Rect outline = {0, 0, 20, 20};
-    SDL_FillRect(coin->img, &outline, SDL_MapRGB(coin->img->format, 0, 0, 0));
-    SDL_Rect inner = {2, 2, 16, 16};
-    SDL_FillRect(coin->img, &inner, SDL_MapRGB(coin->img->format, 255, 215, 0));
-    coin->pos.w = 20;
-    coin->pos.h = 20;
-    coin->visible = 0;
-}
-
-/**
- * @brief Displays a coin on the screen if it is visible.
- * @param coin Pointer to the Coin structure to display.
- * @param screen The SDL surface to draw the coin on.
- */
-void displayCoin(Coin *coin, SDL_Surface *screen) {
-    if (coin->visible) {
-        if (coin->img != NULL) {
-            SDL_BlitSurface(coin->img, NULL, screen, &coin->pos);
-        } else {
-            printf("Coin image is NULL, cannot render coin at position (%d, %d)\n", coin->pos.x, coin->pos.y);
-        }
-    }
-}
-
-/**
- * @brief Checks for collision between a coin and the player using circular approximation.
- * @param coin Pointer to the Coin structure to check collision with.
- * @param posPerso SDL_Rect representing the player's position and size.
- * @return 1 if collision detected, 0 otherwise.
- */
-int collisionTriCoin(Coin *coin, SDL_Rect posPerso) {
-    int estcoli;
-    float R1, R2, X1, X2, D1, D2, Y1, Y2;
-    X1 = posPerso.x + posPerso.w / 2;
-    Y1 = posPerso.y + posPerso.h / 2;
-    R1 = sqrt(pow(posPerso.w / 2, 2) + pow(posPerso.h / 2, 2));
-    if (posPerso.w < posPerso.h) {
-        R1 = posPerso.w / 2;
-    } else {
-        R1 = posPerso.h / 2;
-    }
-    X2 = coin->pos.x + coin->pos.w / 2;
-    Y2 = coin->pos.y + coin->pos.h / 2;
-    R2 = sqrt(pow(coin->pos.w / 2, 2) + pow(coin->pos.h / 2, 2));
-    if (coin->pos.w < coin->pos.h) {
-        R2 = coin->pos.w / 2;
-    } else {
-        R2 = coin->pos.h / 2;
-    }
-    D1 = sqrt(pow(X2 - X1, 2) + pow(Y2 - Y1, 2));
-    D2 = R1 + R2;
-    if (D1 <= D2) {
-        estcoli = 1;
-    } else {
-        estcoli = 0;
-    }
-    return estcoli;
-}
-
 /**
  * @brief Main function to run the game.
  * @param argc Number of command-line arguments.
@@ -123,6 +54,9 @@ int main(int argc, char *argv[]) {
     SDL_Event event;
     image IMAGE;
     Ennemi e;
+    Arena niveau;
+    Particules particules;
+    const size_t taille_niveau = 4 * 1024 * 1024;
     Coin coin1;
     Coin coin2;
     SDL_Surface *perso = IMG_Load("perso.png");
@@ -144,7 +78,16 @@ int main(int argc, char *argv[]) {
 
     screen = SDL_SetVideoMode(1060, 594, 32, SDL_SWSURFACE | SDL_DOUBLEBUF | SDL_RESIZABLE);
     initialiser_imageBACK(&IMAGE);
-    initEnnemi(&e);
+    if (initArena(&niveau, taille_niveau) != 0) {
+        SDL_Quit();
+        return -1;
+    }
+    if (initParticules(&particules, PARTICULES_MAX) != 0) {
+        libererArena(&niveau);
+        SDL_Quit();
+        return -1;
+    }
+    initEnnemi(&e, &niveau);
     initCoin(&coin1);
     initCoin(&coin2);
     coin2.img = IMG_Load("coin.png");
@@ -155,6 +98,10 @@ int main(int argc, char *argv[]) {
 
     Uint32 start;
     const int FPS = 60;
+    SDL_Rect camera = {0, 0, 1060, 594};
+    CullStats stats = {0, 0, 0, 0};
+    int frames_stats = 0;
+    char titre[128];
     while (loop) {
         start = SDL_GetTicks();
         Uint32 current_time = SDL_GetTicks();
@@ -198,26 +145,37 @@ int main(int argc, char *argv[]) {
         afficher_imageBMP(screen, IMAGE);
         SDL_BlitSurface(perso, NULL, screen, &posPerso);
         
+        camera.w = screen->w;
+        camera.h = screen->h;
         if (e.alive) {
-            afficherEnnemi(&e, screen);
-            animerEnemi(&e);
-            if (level == 1) {
-                moveIA(&e, posPerso);
+            int visible = ennemiVisible(&e, camera);
+            if (visible) {
+                afficherEnnemi(&e, screen);
+                animerEnemi(&e);
+                stats.dessins++;
             } else {
-                moveIALevel2(&e, posPerso);
+                stats.dessinsEvites++;
             }
-            draw_health_bar(screen, e.health, (level == 1 ? 50 : 70), e.pos_depart.x, e.pos_depart.y - 15, 40, 10);
+            mettreAJourIA(&e, posPerso, level, visible, &stats);
+            if (visible)
+                draw_health_bar(screen, e.health, (level == 1 ? 50 : 70), e.pos_depart.x, e.pos_depart.y - 15, 40, 10);
         }
 
         if (e.alive && collisionTri(&e, posPerso)) {
             if (current_time - last_hit_time >= hit_cooldown) {
                 int e_was_alive = e.alive;
+                float cx = e.pos_depart.x + e.pos_sprites.w / 2;
+                float cy = e.pos_depart.y + e.pos_sprites.h / 2;
                 e.health -= 10;
                 health -= 5;
+                emettreParticules(&particules, (cx + posPerso.x + posPerso.w / 2) / 2,
+                                  (cy + posPerso.y + posPerso.h / 2) / 2,
+                                  40, 250.0f, 0.4f, SDL_MapRGB(screen->format, 255, 240, 160));
                 if (e.health <= 0 && e_was_alive) {
                     e.alive = 0;
                     score += 100;
                     printf("Enemy defeated! Score: %d\n", score);
+                    emettreParticules(&particules, cx, cy, 400, 350.0f, 1.0f, SDL_MapRGB(screen->format, 255, 80, 0));
                     if (level == 1) {
                         coin1.pos.x = e.pos_depart.x;
                         coin1.pos.y = e.pos_depart.y;
@@ -242,8 +200,11 @@ int main(int argc, char *argv[]) {
             coin1.visible = 0;
             score += 50;
             printf("Coin collected! Score: %d\n", score);
+            emettreParticules(&particules, coin1.pos.x + coin1.pos.w / 2, coin1.pos.y + coin1.pos.h / 2,
+                              200, 200.0f, 0.8f, SDL_MapRGB(screen->format, 255, 215, 0));
             if (level == 1 && !e.alive) {
-                initEnnemiLevel2(&e);
+                arenaReset(&niveau);
+                initEnnemiLevel2(&e, &niveau);
                 level = 2;
             }
         }
@@ -252,14 +213,29 @@ int main(int argc, char *argv[]) {
             coin2.visible = 0;
             score += 50;
             printf("Coin collected! Score: %d\n", score);
+            emettreParticules(&particules, coin2.pos.x + coin2.pos.w / 2, coin2.pos.y + coin2.pos.h / 2,
+                              200, 200.0f, 0.8f, SDL_MapRGB(screen->format, 255, 215, 0));
         }
 
         displayCoin(&coin1, screen);
         displayCoin(&coin2, screen);
 
+        mettreAJourParticules(&particules, 1.0f / FPS);
+        afficherParticules(&particules, screen);
+
         draw_health_bar(screen, health, max_health, 840, 20, 200, 20);
 
         SDL_Flip(screen);
+
+        // Show the average culled work per frame once per second
+        if (++frames_stats == FPS) {
+            sprintf(titre, "enemi - drawn %.2f culled %.2f | AI run %.2f deferred %.2f (per frame)",
+                    (float)stats.dessins / FPS, (float)stats.dessinsEvites / FPS,
+                    (float)stats.iaExecutees / FPS, (float)stats.iaReportees / FPS);
+            SDL_WM_SetCaption(titre, NULL);
+            memset(&stats, 0, sizeof stats);
+            frames_stats = 0;
+        }
         if (1000/FPS > SDL_GetTicks() - start)
             SDL_Delay(1000/FPS - (SDL_GetTicks() - start));
     }
@@ -268,7 +244,8 @@ int main(int argc, char *argv[]) {
     SDL_FreeSurface(perso);
     SDL_FreeSurface(coin1.img);
     SDL_FreeSurface(coin2.img);
-    SDL_FreeSurface(e.spritesheet);
+    libererArena(&niveau);
+    libererParticules(&particules);
     SDL_Quit();
     return 0;
 }
@@ -0,0 +1,181 @@
+/**
+ * @file particules.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Implementation of the particle system used for hit and pickup effects.
+ * This file contains the definitions of functions declared in particules.h,
+ * handling particle emission, integration, lifetime culling and drawing.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <SDL/SDL.h>
+#include "particules.h"
+
+// Xorshift generator, only used when emitting
+static Uint32 aleatoire(Particules *p)
+{
+    Uint32 g = p->graine;
+    g ^= g << 13;
+    g ^= g >> 17;
+    g ^= g << 5;
+    p->graine = g;
+    return g;
+}
+
+// Random float in [0, 1)
+static float aleatoireUnite(Particules *p)
+{
+    return (aleatoire(p) >> 8) * (1.0f / 16777216.0f);
+}
+
+// Allocate every array from a single block
+/**
+ * @brief Allocates the particle arrays.
+ * @param p Pointer to the Particules structure to initialize.
+ * @param capacite Maximum number of live particles.
+ * @return 0 on success, -1 if the arrays could not be allocated.
+ */
+int initParticules(Particules *p, int capacite)
+{
+    // Block aligned to 32 bytes and sizes rounded to 8 floats, so every array starts on a 32-byte boundary
+    int arrondie = (capacite + 7) & ~7;
+    size_t taille = (size_t)arrondie * sizeof(float);
+
+    p->nb = 0;
+    p->graine = 0x9E3779B9u;
+    if (posix_memalign(&p->bloc, 32, taille * 6) != 0)
+    {
+        p->bloc = NULL;
+        printf("Unable to allocate %d particles\n", capacite);
+        p->capacite = 0;
+        return -1;
+    }
+    p->capacite = capacite;
+    p->x = (float *)p->bloc;
+    p->y = p->x + arrondie;
+    p->vx = p->y + arrondie;
+    p->vy = p->vx + arrondie;
+    p->vie = p->vy + arrondie;
+    p->couleur = (Uint32 *)(p->vie + arrondie);
+    return 0;
+}
+
+// Emit a burst of particles in random directions
+/**
+ * @brief Emits a burst of particles in random directions.
+ * @param p Pointer to the Particules structure to emit into.
+ * @param x Horizontal position of the burst.
+ * @param y Vertical position of the burst.
+ * @param nombre Number of particles to emit.
+ * @param vitesse Maximum initial speed, in pixels per second.
+ * @param vie Maximum lifetime, in seconds.
+ * @param couleur Color mapped with SDL_MapRGB for the screen surface.
+ */
+void emettreParticules(Particules *p, float x, float y, int nombre, float vitesse, float vie, Uint32 couleur)
+{
+    int i, fin;
+    float angle, v;
+
+    if (nombre > p->capacite - p->nb)
+        nombre = p->capacite - p->nb;
+    fin = p->nb + nombre;
+    for (i = p->nb; i < fin; i++)
+    {
+        angle = aleatoireUnite(p) * 6.2831853f;
+        v = vitesse * (0.3f + 0.7f * aleatoireUnite(p));
+        p->x[i] = x;
+        p->y[i] = y;
+        p->vx[i] = cosf(angle) * v;
+        p->vy[i] = sinf(angle) * v;
+        p->vie[i] = vie * (0.5f + 0.5f * aleatoireUnite(p));
+        p->couleur[i] = couleur;
+    }
+    p->nb = fin;
+}
+
+// Integrate positions, then compact the arrays to drop expired particles
+/**
+ * @brief Integrates every particle and removes the expired ones.
+ * @param p Pointer to the Particules structure to update.
+ * @param dt Elapsed time, in seconds.
+ */
+void mettreAJourParticules(Particules *p, float dt)
+{
+    float *restrict x = p->x;
+    float *restrict y = p->y;
+    float *restrict vx = p->vx;
+    float *restrict vy = p->vy;
+    float *restrict vie = p->vie;
+    Uint32 *restrict couleur = p->couleur;
+    const float gravite = PARTICULES_GRAVITE * dt;
+    int n = p->nb;
+    int i, j;
+
+    // Branch-free so the compiler can vectorize it
+    for (i = 0; i < n; i++)
+    {
+        vy[i] += gravite;
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+        vie[i] -= dt;
+    }
+
+    for (i = 0, j = 0; i < n; i++)
+    {
+        if (vie[i] > 0.0f)
+        {
+            x[j] = x[i];
+            y[j] = y[i];
+            vx[j] = vx[i];
+            vy[j] = vy[i];
+            vie[j] = vie[i];
+            couleur[j] = couleur[i];
+            j++;
+        }
+    }
+    p->nb = j;
+}
+
+// Write every particle straight into the screen's pixels
+/**
+ * @brief Draws every particle as a single pixel on a 32-bit surface.
+ * @param p Pointer to the Particules structure to draw.
+ * @param screen The SDL surface to draw the particles on.
+ */
+void afficherParticules(Particules *p, SDL_Surface *screen)
+{
+    Uint32 *pixels;
+    int stride, i;
+    float w = (float)screen->w, h = (float)screen->h;
+
+    if (p->nb == 0 || screen->format->BytesPerPixel != 4)
+        return;
+    if (SDL_MUSTLOCK(screen) && SDL_LockSurface(screen) < 0)
+        return;
+
+    pixels = (Uint32 *)screen->pixels;
+    stride = screen->pitch / 4;
+    for (i = 0; i < p->nb; i++)
+    {
+        // Bounds tested on the floats: casting first would truncate (-1, 0) to pixel 0
+        if (p->x[i] >= 0.0f && p->x[i] < w && p->y[i] >= 0.0f && p->y[i] < h)
+            pixels[(int)p->y[i] * stride + (int)p->x[i]] = p->couleur[i];
+    }
+
+    if (SDL_MUSTLOCK(screen))
+        SDL_UnlockSurface(screen);
+}
+
+// Free the block backing every array
+/**
+ * @brief Frees the particle arrays.
+ * @param p Pointer to the Particules structure to free.
+ */
+void libererParticules(Particules *p)
+{
+    free(p->bloc);
+    p->bloc = NULL;
+    p->nb = 0;
+    p->capacite = 0;
+}
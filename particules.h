@@ -0,0 +1,75 @@
+/**
+ * @file particules.h
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Header file defining the particle system used for hit and pickup effects.
+ * Particles are stored as a structure of arrays with a fixed capacity so that the
+ * integration loop can be vectorized and the draw pass writes pixels in one batch.
+ */
+#ifndef PARTICULES_H_INCLUDED
+#define PARTICULES_H_INCLUDED
+
+#include <SDL/SDL.h>
+
+/** @brief Default capacity of the particle system. */
+#define PARTICULES_MAX 65536
+
+/** @brief Downward acceleration applied to every particle, in pixels per second squared. */
+#define PARTICULES_GRAVITE 600.0f
+
+/**
+ * @brief Structure of arrays holding every live particle.
+ * Live particles occupy indices [0, nb) of each array.
+ */
+typedef struct
+{
+  float *x;          /**< Horizontal positions, in pixels */
+  float *y;          /**< Vertical positions, in pixels */
+  float *vx;         /**< Horizontal velocities, in pixels per second */
+  float *vy;         /**< Vertical velocities, in pixels per second */
+  float *vie;        /**< Remaining lifetimes, in seconds */
+  Uint32 *couleur;   /**< Colors, already mapped to the screen format */
+  int nb;            /**< Number of live particles */
+  int capacite;      /**< Maximum number of particles */
+  Uint32 graine;     /**< State of the random generator used when emitting */
+  void *bloc;        /**< Single allocation backing all the arrays */
+} Particules;
+
+/**
+ * @brief Allocates the particle arrays.
+ * @param p Pointer to the Particules structure to initialize.
+ * @param capacite Maximum number of live particles.
+ * @return 0 on success, -1 if the arrays could not be allocated.
+ */
+int initParticules(Particules *p, int capacite);
+/**
+ * @brief Emits a burst of particles in random directions.
+ * Particles that do not fit in the remaining capacity are dropped.
+ * @param p Pointer to the Particules structure to emit into.
+ * @param x Horizontal position of the burst.
+ * @param y Vertical position of the burst.
+ * @param nombre Number of particles to emit.
+ * @param vitesse Maximum initial speed, in pixels per second.
+ * @param vie Maximum lifetime, in seconds.
+ * @param couleur Color mapped with SDL_MapRGB for the screen surface.
+ */
+void emettreParticules(Particules *p, float x, float y, int nombre, float vitesse, float vie, Uint32 couleur);
+/**
+ * @brief Integrates every particle and removes the expired ones.
+ * @param p Pointer to the Particules structure to update.
+ * @param dt Elapsed time, in seconds.
+ */
+void mettreAJourParticules(Particules *p, float dt);
+/**
+ * @brief Draws every particle as a single pixel on a 32-bit surface.
+ * @param p Pointer to the Particules structure to draw.
+ * @param screen The SDL surface to draw the particles on.
+ */
+void afficherParticules(Particules *p, SDL_Surface *screen);
+/**
+ * @brief Frees the particle arrays.
+ * @param p Pointer to the Particules structure to free.
+ */
+void libererParticules(Particules *p);
+
+#endif
@@ -0,0 +1,527 @@
+/**
+ * @file simulation.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Implementation of the batched headless simulation of many game sessions.
+ * This file contains the definitions of functions declared in simulation.h.
+ * The rules mirror main.c and the AI functions of enemy.c frame for frame.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "simulation.h"
+
+// Same values as enum STATE in enemy.h, which cannot be included without SDL
+enum { SIM_WAITING, SIM_FOLLOWING, SIM_ATTACKING };
+
+/** @brief Number of int-sized arrays in Sessions. */
+#define SIM_NB_TABLEAUX 20
+
+/** @brief Number of sched_yield() rounds a waiting thread spins before it sleeps. */
+#define SIM_ATTENTE_ACTIVE 200
+
+/**
+ * @brief Work given to one thread: a contiguous shard of sessions.
+ */
+typedef struct
+{
+  Sessions *s;              /**< Sessions being stepped */
+  const int *directions;    /**< Inputs of every session for every frame, or NULL */
+  int debut;                /**< First session of the shard */
+  int fin;                  /**< One past the last session of the shard */
+  int pas;                  /**< Number of frames to simulate */
+} Tranche;
+
+/**
+ * @brief Persistent worker threads, started by initSessions() and stopped by libererSessions().
+ */
+struct PoolSessions
+{
+  pthread_t *threads;       /**< Worker threads; thread t runs shard t + 1 */
+  Tranche *tranches;        /**< One shard per thread, shard 0 runs on the caller */
+  int nbTravailleurs;       /**< Number of worker threads started */
+  pthread_mutex_t verrou;   /**< Protects the sleeps and wake-ups below */
+  pthread_cond_t depart;    /**< Signalled when a new batch is posted */
+  pthread_cond_t fin;       /**< Signalled when the last worker finishes a batch */
+  atomic_int generation;    /**< Incremented for every batch */
+  atomic_int restants;      /**< Workers still running the current batch */
+  int arret;                /**< Set by libererSessions() to stop the workers */
+};
+
+static void *avancerTranche(void *arg);
+
+// Worker loop: wait for a batch, run its shard, report back
+static void *travailleur(void *arg)
+{
+    Tranche *t = (Tranche *)arg;
+    struct PoolSessions *pool = t->s->pool;
+    int vue = 0, tours;
+
+    for (;;)
+    {
+        // Spin briefly first: a bot stepping with pas = 1 posts batches back to back
+        for (tours = 0; tours < SIM_ATTENTE_ACTIVE && atomic_load(&pool->generation) == vue; tours++)
+            sched_yield();
+
+        pthread_mutex_lock(&pool->verrou);
+        while (atomic_load(&pool->generation) == vue && !pool->arret)
+            pthread_cond_wait(&pool->depart, &pool->verrou);
+        if (pool->arret)
+        {
+            pthread_mutex_unlock(&pool->verrou);
+            return NULL;
+        }
+        vue = atomic_load(&pool->generation);
+        pthread_mutex_unlock(&pool->verrou);
+
+        avancerTranche(t);
+
+        if (atomic_fetch_sub(&pool->restants, 1) == 1)
+        {
+            pthread_mutex_lock(&pool->verrou);
+            pthread_cond_signal(&pool->fin);
+            pthread_mutex_unlock(&pool->verrou);
+        }
+    }
+}
+
+// Start the worker threads and split the sessions into contiguous shards
+static int initPool(Sessions *s, int nbThreads)
+{
+    struct PoolSessions *pool;
+    int nb, taille, t;
+
+    // No more threads than there are cache lines of sessions to share out
+    nb = (s->n + 15) / 16;
+    if (nb > nbThreads)
+        nb = nbThreads;
+    if (nb < 1)
+        nb = 1;
+
+    pool = calloc(1, sizeof(struct PoolSessions));
+    if (pool == NULL)
+        return -1;
+    pool->threads = malloc(sizeof(pthread_t) * nb);
+    pool->tranches = calloc(nb, sizeof(Tranche));
+    if (pool->threads == NULL || pool->tranches == NULL)
+    {
+        free(pool->threads);
+        free(pool->tranches);
+        free(pool);
+        return -1;
+    }
+    pthread_mutex_init(&pool->verrou, NULL);
+    pthread_cond_init(&pool->depart, NULL);
+    pthread_cond_init(&pool->fin, NULL);
+    atomic_init(&pool->generation, 0);
+    atomic_init(&pool->restants, 0);
+    s->pool = pool;
+
+    for (t = 0; t < nb; t++)
+        pool->tranches[t].s = s;
+    // If a thread cannot start, run with the ones that did
+    for (t = 1; t < nb; t++)
+    {
+        if (pthread_create(&pool->threads[t - 1], NULL, travailleur, &pool->tranches[t]) != 0)
+            break;
+        pool->nbTravailleurs = t;
+    }
+    nb = pool->nbTravailleurs + 1;
+    s->nbThreads = nb;
+
+    // Shards start on multiples of 16 ints, i.e. on cache lines, so threads never share one
+    taille = ((s->n + nb - 1) / nb + 15) & ~15;
+    for (t = 0; t < nb; t++)
+    {
+        pool->tranches[t].debut = t * taille < s->n ? t * taille : s->n;
+        pool->tranches[t].fin = (t + 1) * taille < s->n ? (t + 1) * taille : s->n;
+    }
+    return 0;
+}
+
+// Allocate every array from a single block
+/**
+ * @brief Allocates and resets n sessions.
+ * @param s Pointer to the Sessions structure to initialize.
+ * @param n Number of sessions.
+ * @param persoW Width of the player sprite (perso.png).
+ * @param persoH Height of the player sprite (perso.png).
+ * @param nbThreads Number of threads to step with, or 0 to use every online core.
+ * @return 0 on success, -1 on failure.
+ */
+int initSessions(Sessions *s, int n, int persoW, int persoH, int nbThreads)
+{
+    // Block aligned to 64 bytes and sizes rounded to 16 ints, so every array starts on a cache line
+    int arrondi = (n + 15) & ~15;
+    int *t;
+    int i;
+
+    // Set before anything can fail, so libererSessions() is safe after a failed init
+    s->pool = NULL;
+    s->nbThreads = 0;
+    s->n = 0;
+
+    if (posix_memalign(&s->bloc, 64, (size_t)arrondi * SIM_NB_TABLEAUX * sizeof(int)) != 0)
+    {
+        s->bloc = NULL;
+        printf("Unable to allocate %d simulation sessions\n", n);
+        s->n = 0;
+        return -1;
+    }
+    if (nbThreads <= 0)
+        nbThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThreads <= 0)
+        nbThreads = 1;
+
+    s->n = n;
+    s->persoW = persoW;
+    s->persoH = persoH;
+
+    t = (int *)s->bloc;
+    s->persoX = t;          t += arrondi;
+    s->persoY = t;          t += arrondi;
+    s->persoVie = t;        t += arrondi;
+    s->ennemiX = t;         t += arrondi;
+    s->ennemiY = t;         t += arrondi;
+    s->ennemiDirection = t; t += arrondi;
+    s->ennemiEtat = t;      t += arrondi;
+    s->ennemiVie = t;       t += arrondi;
+    s->ennemiVivant = t;    t += arrondi;
+    s->coin1X = t;          t += arrondi;
+    s->coin1Y = t;          t += arrondi;
+    s->coin1Visible = t;    t += arrondi;
+    s->coin2X = t;          t += arrondi;
+    s->coin2Y = t;          t += arrondi;
+    s->coin2Visible = t;    t += arrondi;
+    s->score = t;           t += arrondi;
+    s->niveau = t;          t += arrondi;
+    s->termine = t;         t += arrondi;
+    s->temps = (unsigned int *)t;       t += arrondi;
+    s->dernierCoup = (unsigned int *)t; t += arrondi;
+
+    for (i = 0; i < n; i++)
+        reinitialiserSession(s, i);
+
+    if (initPool(s, nbThreads) != 0)
+    {
+        printf("Unable to start the simulation threads\n");
+        free(s->bloc);
+        s->bloc = NULL;
+        s->n = 0;
+        return -1;
+    }
+    return 0;
+}
+
+// Put the Level 2 enemy in place, as initEnnemiLevel2() does
+static void initEnnemiLevel2Session(Sessions *s, int i)
+{
+    s->ennemiX[i] = 500;
+    s->ennemiY[i] = 500;
+    s->ennemiDirection[i] = 0;
+    s->ennemiVie[i] = 70;
+    s->ennemiVivant[i] = 1;
+    s->ennemiEtat[i] = SIM_WAITING;
+}
+
+// Start a new game, with the values used by main() and initEnnemi()
+/**
+ * @brief Puts one session back in the state of a new game.
+ * @param s Pointer to the Sessions structure.
+ * @param i Index of the session to reset.
+ */
+void reinitialiserSession(Sessions *s, int i)
+{
+    s->persoX[i] = 10;
+    s->persoY[i] = 450;
+    s->persoVie[i] = 100;
+
+    s->ennemiX[i] = 260;
+    s->ennemiY[i] = 100;
+    s->ennemiDirection[i] = 0;
+    s->ennemiEtat[i] = SIM_WAITING;
+    s->ennemiVie[i] = 50;
+    s->ennemiVivant[i] = 1;
+
+    s->coin1X[i] = 0;
+    s->coin1Y[i] = 0;
+    s->coin1Visible[i] = 0;
+    s->coin2X[i] = 0;
+    s->coin2Y[i] = 0;
+    s->coin2Visible[i] = 0;
+
+    s->score[i] = 0;
+    s->niveau[i] = 1;
+    s->termine[i] = 0;
+    s->temps[i] = 0;
+    s->dernierCoup[i] = 0;
+}
+
+// Same thresholds as updateEnnemiState()
+static int etatSelonDistance(int distx, int disty)
+{
+    if (distx > 150 && disty > 150)
+        return SIM_WAITING;
+    if (distx <= 50 && disty <= 50)
+        return SIM_ATTACKING;
+    return SIM_FOLLOWING;
+}
+
+// Circle test of collisionTri() and collisionTriCoin(), without the square root
+static int collisionCercles(int x1, int y1, int w1, int h1, int x2, int y2, int w2, int h2)
+{
+    int dx = (x2 + w2 / 2) - (x1 + w1 / 2);
+    int dy = (y2 + h2 / 2) - (y1 + h1 / 2);
+    int r = (w1 < h1 ? w1 / 2 : h1 / 2) + (w2 < h2 ? w2 / 2 : h2 / 2);
+    return dx * dx + dy * dy <= r * r;
+}
+
+// Enemy AI of one session, mirroring moveIA() and moveIALevel2()
+static void avancerEnnemi(Sessions *s, int i)
+{
+    int px = s->persoX[i], py = s->persoY[i];
+    int ex = s->ennemiX[i], ey = s->ennemiY[i];
+    int dx = abs(ex - px);
+    int dy = abs(ey - py);
+
+    if (s->niveau[i] == 1)
+    {
+        switch (s->ennemiEtat[i])
+        {
+        case SIM_WAITING:
+            if (ey < 12)
+                s->ennemiDirection[i] = 1;
+            else if (ey > 400)
+                s->ennemiDirection[i] = 0;
+            if (s->ennemiDirection[i] == 1)
+                ey += 7;
+            if (s->ennemiDirection[i] == 0)
+                ey -= 7;
+            break;
+        case SIM_FOLLOWING:
+            if (ex > px)
+            {
+                ex -= 3;
+                if (ey > py)
+                    ey -= 3;
+                if (ey < py)
+                    ey += 3;
+            }
+            if (ex < px)
+            {
+                ex += 3;
+                if (ey > py)
+                    ey -= 3;
+                if (ey < py)
+                    ey += 3;
+            }
+            break;
+        }
+        s->ennemiEtat[i] = etatSelonDistance(dx, dy);
+    }
+    else
+    {
+        ey = 500;
+        s->ennemiEtat[i] = etatSelonDistance(dx, dy);
+        if (s->ennemiEtat[i] == SIM_FOLLOWING)
+        {
+            if (ex > px)
+                ex -= 10;
+            else if (ex < px)
+                ex += 10;
+        }
+    }
+
+    s->ennemiX[i] = ex;
+    s->ennemiY[i] = ey;
+}
+
+// Hits, enemy death, coin pickups and level change of one session, as in main()
+static void avancerRegles(Sessions *s, int i)
+{
+    const int px = s->persoX[i], py = s->persoY[i];
+    const int pw = s->persoW, ph = s->persoH;
+
+    if (s->ennemiVivant[i] &&
+        collisionCercles(px, py, pw, ph, s->ennemiX[i], s->ennemiY[i], 64, 64) &&
+        s->temps[i] - s->dernierCoup[i] >= 500)
+    {
+        s->ennemiVie[i] -= 10;
+        s->persoVie[i] -= 5;
+        if (s->ennemiVie[i] <= 0)
+        {
+            s->ennemiVivant[i] = 0;
+            s->score[i] += 100;
+            if (s->niveau[i] == 1)
+            {
+                s->coin1X[i] = s->ennemiX[i];
+                s->coin1Y[i] = s->ennemiY[i];
+                s->coin1Visible[i] = 1;
+            }
+            else
+            {
+                s->coin2X[i] = s->ennemiX[i];
+                s->coin2Y[i] = s->ennemiY[i];
+                s->coin2Visible[i] = 1;
+            }
+        }
+        if (s->persoVie[i] <= 0)
+            s->termine[i] = 1;
+        s->dernierCoup[i] = s->temps[i];
+    }
+
+    if (s->coin1Visible[i] && collisionCercles(px, py, pw, ph, s->coin1X[i], s->coin1Y[i], 20, 20))
+    {
+        s->coin1Visible[i] = 0;
+        s->score[i] += 50;
+        if (s->niveau[i] == 1 && !s->ennemiVivant[i])
+        {
+            initEnnemiLevel2Session(s, i);
+            s->niveau[i] = 2;
+        }
+    }
+
+    if (s->coin2Visible[i] && collisionCercles(px, py, pw, ph, s->coin2X[i], s->coin2Y[i], 20, 20))
+    {
+        s->coin2Visible[i] = 0;
+        s->score[i] += 50;
+    }
+}
+
+// Clamp a player coordinate to [0, max], as main() does after moving
+static inline int borner(int v, int max)
+{
+    v = v < 0 ? 0 : v;
+    return v > max ? max : v;
+}
+
+// Simulate every frame for one shard of sessions
+static void *avancerTranche(void *arg)
+{
+    Tranche *t = (Tranche *)arg;
+    Sessions *s = t->s;
+    int *restrict persoX = s->persoX;
+    int *restrict persoY = s->persoY;
+    unsigned int *restrict temps = s->temps;
+    const int *restrict termine = s->termine;
+    const int *restrict ligne;
+    // Locals, so the stores below cannot alias the loop bounds and the loops vectorize
+    const int debut = t->debut;
+    const int fin = t->fin;
+    const int pas = t->pas;
+    const int xMax = SIM_LARGEUR - s->persoW;
+    const int yMax = SIM_HAUTEUR - s->persoH;
+    int k, i, d, dx, dy;
+
+    for (k = 0; k < pas; k++)
+    {
+        // Player movement and clamping, branch-free so it vectorizes across sessions
+        if (t->directions != NULL)
+        {
+            ligne = t->directions + (size_t)k * s->n;
+            for (i = debut; i < fin; i++)
+            {
+                d = ligne[i];
+                dx = 5 * ((d == 1) - (d == 0));
+                dy = 5 * ((d == 2) - (d == 3));
+                persoX[i] = borner(persoX[i] + (termine[i] ? 0 : dx), xMax);
+                persoY[i] = borner(persoY[i] + (termine[i] ? 0 : dy), yMax);
+            }
+        }
+        else
+        {
+            for (i = debut; i < fin; i++)
+            {
+                persoX[i] = borner(persoX[i], xMax);
+                persoY[i] = borner(persoY[i], yMax);
+            }
+        }
+
+        // Enemy AI and game rules stay scalar, one session at a time
+        for (i = debut; i < fin; i++)
+        {
+            if (termine[i])
+                continue;
+            if (s->ennemiVivant[i])
+                avancerEnnemi(s, i);
+            avancerRegles(s, i);
+        }
+
+        for (i = debut; i < fin; i++)
+            temps[i] += (unsigned int)(!termine[i]) * SIM_PAS_MS;
+    }
+    return NULL;
+}
+
+// Post one batch to the worker pool and run shard 0 on the calling thread
+/**
+ * @brief Steps every session forward.
+ * @param s Pointer to the Sessions structure to step.
+ * @param directions Inputs laid out as directions[frame][session], or NULL for no input.
+ * @param pas Number of frames to simulate.
+ */
+void avancerSessions(Sessions *s, const int *directions, int pas)
+{
+    struct PoolSessions *pool = s->pool;
+    int t, tours;
+
+    for (t = 0; t <= pool->nbTravailleurs; t++)
+    {
+        pool->tranches[t].directions = directions;
+        pool->tranches[t].pas = pas;
+    }
+    if (pool->nbTravailleurs == 0)
+    {
+        avancerTranche(&pool->tranches[0]);
+        return;
+    }
+
+    atomic_store(&pool->restants, pool->nbTravailleurs);
+    pthread_mutex_lock(&pool->verrou);
+    atomic_fetch_add(&pool->generation, 1);
+    pthread_cond_broadcast(&pool->depart);
+    pthread_mutex_unlock(&pool->verrou);
+
+    avancerTranche(&pool->tranches[0]);
+
+    for (tours = 0; tours < SIM_ATTENTE_ACTIVE && atomic_load(&pool->restants) > 0; tours++)
+        sched_yield();
+    pthread_mutex_lock(&pool->verrou);
+    while (atomic_load(&pool->restants) > 0)
+        pthread_cond_wait(&pool->fin, &pool->verrou);
+    pthread_mutex_unlock(&pool->verrou);
+}
+
+// Free the block backing every array
+/**
+ * @brief Frees every session.
+ * @param s Pointer to the Sessions structure to free.
+ */
+void libererSessions(Sessions *s)
+{
+    struct PoolSessions *pool = s->pool;
+    int t;
+
+    if (pool != NULL)
+    {
+        pthread_mutex_lock(&pool->verrou);
+        pool->arret = 1;
+        pthread_cond_broadcast(&pool->depart);
+        pthread_mutex_unlock(&pool->verrou);
+        for (t = 0; t < pool->nbTravailleurs; t++)
+            pthread_join(pool->threads[t], NULL);
+        pthread_mutex_destroy(&pool->verrou);
+        pthread_cond_destroy(&pool->depart);
+        pthread_cond_destroy(&pool->fin);
+        free(pool->threads);
+        free(pool->tranches);
+        free(pool);
+        s->pool = NULL;
+    }
+    free(s->bloc);
+    s->bloc = NULL;
+    s->n = 0;
+}
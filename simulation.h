@@ -0,0 +1,99 @@
+/**
+ * @file simulation.h
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Header file defining the batched headless simulation of many game sessions.
+ * Each session replays the rules of main.c (player, enemy AI, coins, score and level
+ * progression) without SDL. The state of all sessions is stored as a structure of
+ * arrays so one step runs the same code over contiguous data, and sessions are split
+ * into shards stepped by a pool of worker threads kept alive between calls.
+ */
+#ifndef SIMULATION_H_INCLUDED
+#define SIMULATION_H_INCLUDED
+
+/** @brief Width of the game screen, in pixels. */
+#define SIM_LARGEUR 1060
+
+/** @brief Height of the game screen, in pixels. */
+#define SIM_HAUTEUR 594
+
+/** @brief Duration of one simulated frame, in milliseconds (60 FPS as in main.c). */
+#define SIM_PAS_MS (1000 / 60)
+
+struct PoolSessions;
+
+/**
+ * @brief Structure of arrays holding the state of every session.
+ * Entry i of each array belongs to session i. Enemy states use the values of STATE
+ * (WAITING, FOLLOWING, ATTACKING) from enemy.h.
+ */
+typedef struct
+{
+  int n;                  /**< Number of sessions */
+  int nbThreads;          /**< Number of threads stepping sessions, the caller included */
+  int persoW;             /**< Width of the player sprite */
+  int persoH;             /**< Height of the player sprite */
+
+  int *persoX;            /**< Player horizontal position */
+  int *persoY;            /**< Player vertical position */
+  int *persoVie;          /**< Player health */
+
+  int *ennemiX;           /**< Enemy horizontal position */
+  int *ennemiY;           /**< Enemy vertical position */
+  int *ennemiDirection;   /**< Enemy patrol direction (0 = up, 1 = down) */
+  int *ennemiEtat;        /**< Enemy AI state */
+  int *ennemiVie;         /**< Enemy health */
+  int *ennemiVivant;      /**< Flag to check if the enemy is alive */
+
+  int *coin1X;            /**< Position of the coin dropped on Level 1 */
+  int *coin1Y;
+  int *coin1Visible;      /**< Flag to check if the Level 1 coin is visible */
+  int *coin2X;            /**< Position of the coin dropped on Level 2 */
+  int *coin2Y;
+  int *coin2Visible;      /**< Flag to check if the Level 2 coin is visible */
+
+  int *score;             /**< Score of the session */
+  int *niveau;            /**< Current level (1 or 2) */
+  int *termine;           /**< Set once the player is defeated; the session stops stepping */
+  unsigned int *temps;    /**< Simulated time, in milliseconds */
+  unsigned int *dernierCoup; /**< Time of the last hit, for the hit cooldown */
+
+  void *bloc;             /**< Single allocation backing all the arrays */
+  struct PoolSessions *pool; /**< Worker threads; they keep a pointer to this structure, so it must not move */
+} Sessions;
+
+/**
+ * @brief Allocates and resets n sessions and starts the worker threads.
+ * @param s Pointer to the Sessions structure to initialize.
+ * @param n Number of sessions.
+ * @param persoW Width of the player sprite (perso.png).
+ * @param persoH Height of the player sprite (perso.png).
+ * @param nbThreads Number of threads to step with, or 0 to use every online core.
+ * No more than one thread per 16 sessions is started.
+ * @return 0 on success, -1 on failure.
+ */
+int initSessions(Sessions *s, int n, int persoW, int persoH, int nbThreads);
+/**
+ * @brief Puts one session back in the state of a new game.
+ * @param s Pointer to the Sessions structure.
+ * @param i Index of the session to reset.
+ */
+void reinitialiserSession(Sessions *s, int i);
+/**
+ * @brief Steps every session forward.
+ * The worker threads are reused between calls, so stepping one frame at a time
+ * (pas = 1) with a new input each frame stays cheap.
+ * @param s Pointer to the Sessions structure to step.
+ * @param directions Inputs laid out as directions[frame][session], i.e. pas rows of
+ * n entries, using the codes of main.c (-1 = none, 0 = left, 1 = right, 2 = down,
+ * 3 = up), or NULL for no input.
+ * @param pas Number of frames to simulate.
+ */
+void avancerSessions(Sessions *s, const int *directions, int pas);
+/**
+ * @brief Stops the worker threads and frees every session.
+ * @param s Pointer to the Sessions structure to free.
+ */
+void libererSessions(Sessions *s);
+
+#endif
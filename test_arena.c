@@ -0,0 +1,53 @@
+/**
+ * @file test_arena.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Checks that repeated level loads through the arena do not grow.
+ * Loads the Level 1 enemy 1,000 times with an arenaReset() between loads, as the
+ * level transition in main.c does, and fails if the high-water mark or the number
+ * of live surfaces changes after the first load. Run from the directory holding batt.png.
+ */
+#include <stdio.h>
+#include <SDL/SDL.h>
+#include "arena.h"
+#include "enemy.h"
+
+int main(int argc, char *argv[])
+{
+    Arena niveau;
+    Ennemi e;
+    size_t pic = 0;
+    int i;
+
+    if (SDL_Init(0) == -1) {
+        printf("SDL init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+    if (initArena(&niveau, 4 * 1024 * 1024) != 0)
+        return 1;
+
+    for (i = 0; i < 1000; i++) {
+        arenaReset(&niveau);
+        if (niveau.nbSurfaces != 0) {
+            printf("FAIL: %d surfaces still live after reset %d\n", niveau.nbSurfaces, i);
+            return 1;
+        }
+        initEnnemi(&e, &niveau);
+        if (e.spritesheet == NULL || niveau.nbSurfaces != 1) {
+            printf("FAIL: load %d left %d surfaces\n", i, niveau.nbSurfaces);
+            return 1;
+        }
+        if (i == 0)
+            pic = arenaPic(&niveau);
+        else if (arenaPic(&niveau) != pic) {
+            printf("FAIL: high-water mark grew from %lu to %lu at load %d\n",
+                   (unsigned long)pic, (unsigned long)arenaPic(&niveau), i);
+            return 1;
+        }
+    }
+
+    printf("OK: 1000 level loads, high-water mark %lu bytes\n", (unsigned long)pic);
+    libererArena(&niveau);
+    SDL_Quit();
+    return 0;
+}
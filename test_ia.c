@@ -0,0 +1,110 @@
+/**
+ * @file test_ia.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Checks the enemy AI level of detail against a per-frame update.
+ * Compares moveN() with repeated calls to move() for every start position, direction
+ * and step count, then walks the player from far away up to a culled Level 1 enemy
+ * and checks that mettreAJourIA() leaves the enemy where a per-frame moveIA() would
+ * after every update it actually runs. Needs no image files.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <SDL/SDL.h>
+#include "enemy.h"
+
+#define NB_FRAMES 600
+
+// A Level 1 enemy as initEnnemi() leaves it, without its spritesheet
+static void initModele(Ennemi *e)
+{
+    memset(e, 0, sizeof(Ennemi));
+    e->pos_depart.x = 800;
+    e->pos_depart.y = 200;
+    e->direction = 0;
+    e->frameWidth = 40;
+    e->frameHeight = 40;
+    e->alive = 1;
+    e->state = WAITING;
+    e->health = 50;
+}
+
+// Player path: far below the enemy at first, then walking up to it
+static SDL_Rect positionJoueur(int k)
+{
+    SDL_Rect pos = {0, 0, 40, 60};
+    pos.x = (k * 3) % 300;
+    pos.y = k < 300 ? 1000 : 1000 - 5 * (k - 300);
+    return pos;
+}
+
+static int memePosition(Ennemi *a, Ennemi *b)
+{
+    return a->pos_depart.x == b->pos_depart.x && a->pos_depart.y == b->pos_depart.y &&
+           a->direction == b->direction && a->state == b->state;
+}
+
+// Run the path once through mettreAJourIA() and once through moveIA()
+static int verifierIA(int visible, CullStats *stats)
+{
+    Ennemi lod, reference;
+    SDL_Rect pos;
+    int k, executees;
+
+    initModele(&lod);
+    initModele(&reference);
+    for (k = 0; k < NB_FRAMES; k++) {
+        pos = positionJoueur(k);
+        executees = stats->iaExecutees;
+        mettreAJourIA(&lod, pos, 1, visible, stats);
+        moveIA(&reference, pos);
+        if (stats->iaExecutees != executees && !memePosition(&lod, &reference)) {
+            printf("FAIL: %s enemy at %d,%d (state %d) instead of %d,%d (state %d) at frame %d\n",
+                   visible ? "visible" : "culled", lod.pos_depart.x, lod.pos_depart.y, lod.state,
+                   reference.pos_depart.x, reference.pos_depart.y, reference.state, k);
+            return 1;
+        }
+        if (visible && stats->iaExecutees == executees) {
+            printf("FAIL: visible enemy deferred at frame %d\n", k);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Ennemi a, b;
+    CullStats cache = {0, 0, 0, 0}, visible = {0, 0, 0, 0};
+    int y, direction, n, k;
+
+    for (y = -20; y <= 430; y++) {
+        for (direction = 0; direction <= 1; direction++) {
+            for (n = 0; n <= 200; n++) {
+                initModele(&a);
+                a.pos_depart.y = y;
+                a.direction = direction;
+                b = a;
+                moveN(&a, n);
+                for (k = 0; k < n; k++)
+                    move(&b);
+                if (a.pos_depart.y != b.pos_depart.y || a.direction != b.direction) {
+                    printf("FAIL: moveN from y=%d direction %d, %d steps: y=%d instead of %d\n",
+                           y, direction, n, a.pos_depart.y, b.pos_depart.y);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    if (verifierIA(0, &cache) || verifierIA(1, &visible))
+        return 1;
+    if (cache.iaReportees == 0) {
+        printf("FAIL: the culled enemy was never deferred\n");
+        return 1;
+    }
+
+    printf("OK: moveN matches move, culled enemy ran %d of %d AI updates\n",
+           cache.iaExecutees, cache.iaExecutees + cache.iaReportees);
+    return 0;
+}
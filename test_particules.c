@@ -0,0 +1,190 @@
+/**
+ * @file test_particules.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Checks the particle system and its frame budget.
+ * Checks emission, integration, compaction of expired particles and drawing
+ * (including particles just left of or above the screen), then times
+ * mettreAJourParticules() on 50,000 live particles and fails if a frame takes
+ * more than 2 ms on average. Needs no image files.
+ */
+#include <stdio.h>
+#include <math.h>
+#include <SDL/SDL.h>
+#include "particules.h"
+
+#define NB_PERF 50000
+#define FRAMES_PERF 500
+#define BUDGET_MS 2.0
+
+static int proche(float a, float b)
+{
+    return fabsf(a - b) <= 1e-3f * (1.0f + fabsf(b));
+}
+
+// Emit two bursts and check where every particle starts
+static int verifierEmission(Particules *p)
+{
+    int i;
+    float v;
+
+    emettreParticules(p, 100.0f, 50.0f, 300, 200.0f, 1.0f, 7);
+    emettreParticules(p, 20.0f, 30.0f, 300, 100.0f, 0.1f, 9);
+    if (p->nb != 600) {
+        printf("FAIL: %d particles after emitting 600\n", p->nb);
+        return 1;
+    }
+    for (i = 0; i < p->nb; i++) {
+        int premiere = i < 300;
+        v = sqrtf(p->vx[i] * p->vx[i] + p->vy[i] * p->vy[i]);
+        if (p->x[i] != (premiere ? 100.0f : 20.0f) || p->y[i] != (premiere ? 50.0f : 30.0f) ||
+            p->couleur[i] != (premiere ? 7u : 9u) ||
+            v < 0.3f * (premiere ? 200.0f : 100.0f) - 1e-3f || v > (premiere ? 200.0f : 100.0f) + 1e-3f ||
+            p->vie[i] < 0.5f * (premiere ? 1.0f : 0.1f) || p->vie[i] > (premiere ? 1.0f : 0.1f)) {
+            printf("FAIL: particle %d emitted with a wrong position, speed, lifetime or color\n", i);
+            return 1;
+        }
+    }
+
+    // Bursts are clipped to the capacity
+    emettreParticules(p, 0.0f, 0.0f, p->capacite, 10.0f, 1.0f, 1);
+    if (p->nb != p->capacite) {
+        printf("FAIL: %d particles after filling a capacity of %d\n", p->nb, p->capacite);
+        return 1;
+    }
+    p->nb = 600;
+    return 0;
+}
+
+// One step must match the scalar formulas, and expired particles must go in order
+static int verifierMiseAJour(Particules *p)
+{
+    static float x[600], y[600], vx[600], vy[600], vie[600];
+    const float dt = 1.0f / 60.0f;
+    int i, k;
+
+    for (i = 0; i < p->nb; i++) {
+        x[i] = p->x[i];
+        y[i] = p->y[i];
+        vx[i] = p->vx[i];
+        vy[i] = p->vy[i];
+        vie[i] = p->vie[i];
+    }
+    mettreAJourParticules(p, dt);
+    for (i = 0; i < p->nb; i++) {
+        float vyAttendue = vy[i] + PARTICULES_GRAVITE * dt;
+        if (!proche(p->vy[i], vyAttendue) || !proche(p->x[i], x[i] + vx[i] * dt) ||
+            !proche(p->y[i], y[i] + vyAttendue * dt) || !proche(p->vie[i], vie[i] - dt)) {
+            printf("FAIL: particle %d integrated to %f,%f instead of %f,%f\n", i,
+                   p->x[i], p->y[i], x[i] + vx[i] * dt, y[i] + vyAttendue * dt);
+            return 1;
+        }
+    }
+
+    // The second burst lives at most 0.1 s: after 0.2 s only the first one is left
+    for (k = 0; k < 11; k++)
+        mettreAJourParticules(p, dt);
+    if (p->nb != 300) {
+        printf("FAIL: %d particles left instead of 300\n", p->nb);
+        return 1;
+    }
+    for (i = 0; i < p->nb; i++) {
+        if (p->couleur[i] != 7 || p->vie[i] <= 0.0f ||
+            !proche(p->x[i], x[i] + vx[i] * dt * 12)) {
+            printf("FAIL: particle %d is not the survivor expected after compaction\n", i);
+            return 1;
+        }
+    }
+
+    for (k = 0; k < 60; k++)
+        mettreAJourParticules(p, dt);
+    if (p->nb != 0) {
+        printf("FAIL: %d particles outlived their lifetime\n", p->nb);
+        return 1;
+    }
+    return 0;
+}
+
+// Particles in (-1, 0) must not land on column or row 0
+static int verifierAffichage(Particules *p)
+{
+    SDL_Surface *ecran = SDL_CreateRGBSurface(SDL_SWSURFACE, 8, 4, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+    Uint32 *pixels;
+    int stride, x, y, erreur = 0;
+
+    if (ecran == NULL) {
+        printf("FAIL: unable to create a test surface: %s\n", SDL_GetError());
+        return 1;
+    }
+    SDL_FillRect(ecran, NULL, 0);
+    p->nb = 0;
+    emettreParticules(p, 0.0f, 0.0f, 5, 0.0f, 1.0f, 0);
+    p->x[0] = -0.5f; p->y[0] = 1.0f; p->couleur[0] = 1;
+    p->x[1] = 2.0f;  p->y[1] = -0.5f; p->couleur[1] = 2;
+    p->x[2] = 3.7f;  p->y[2] = 2.2f; p->couleur[2] = 3;
+    p->x[3] = 8.0f;  p->y[3] = 0.0f; p->couleur[3] = 4;
+    p->x[4] = 0.0f;  p->y[4] = 3.9f; p->couleur[4] = 5;
+    afficherParticules(p, ecran);
+
+    pixels = (Uint32 *)ecran->pixels;
+    stride = ecran->pitch / 4;
+    for (y = 0; y < 4; y++) {
+        for (x = 0; x < 8; x++) {
+            Uint32 attendu = (x == 3 && y == 2) ? 3 : ((x == 0 && y == 3) ? 5 : 0);
+            if (pixels[y * stride + x] != attendu) {
+                printf("FAIL: pixel %d,%d is %u instead of %u\n", x, y, pixels[y * stride + x], attendu);
+                erreur = 1;
+            }
+        }
+    }
+    SDL_FreeSurface(ecran);
+    p->nb = 0;
+    return erreur;
+}
+
+// Average update time over FRAMES_PERF frames with NB_PERF live particles
+static int verifierBudget(Particules *p)
+{
+    Uint32 debut, duree;
+    double parFrame;
+    int k;
+
+    p->nb = 0;
+    emettreParticules(p, 530.0f, 300.0f, NB_PERF, 300.0f, 1000.0f, 1);
+    debut = SDL_GetTicks();
+    for (k = 0; k < FRAMES_PERF; k++)
+        mettreAJourParticules(p, 1.0f / 60.0f);
+    duree = SDL_GetTicks() - debut;
+    parFrame = (double)duree / FRAMES_PERF;
+
+    if (p->nb != NB_PERF) {
+        printf("FAIL: %d of %d particles left during the timing run\n", p->nb, NB_PERF);
+        return 1;
+    }
+    printf("%d particles: %.3f ms per update\n", NB_PERF, parFrame);
+    if (parFrame > BUDGET_MS) {
+        printf("FAIL: update over the %.1f ms budget\n", BUDGET_MS);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Particules p;
+
+    if (SDL_Init(SDL_INIT_TIMER) == -1) {
+        printf("SDL init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+    if (initParticules(&p, PARTICULES_MAX) != 0)
+        return 1;
+
+    if (verifierEmission(&p) || verifierMiseAJour(&p) || verifierAffichage(&p) || verifierBudget(&p))
+        return 1;
+
+    printf("OK: emission, integration, compaction and drawing\n");
+    libererParticules(&p);
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file test_simulation.c
+ * @author [Your Name]
+ * @date May 11, 2025
+ * @brief Checks the batched simulation against the game's own functions.
+ * Runs 2000 sessions for 3000 frames twice: once through avancerSessions(), once
+ * through a scalar reference that replays the frame of main.c with the functions of
+ * enemy.c (mettreAJourIA, collisionTri, collisionTriCoin). Every session is driven by
+ * a bot choosing a new input each frame, and the full state must match after every frame.
+ * A second copy of the sessions is stepped PAS_LOT frames per call from the same inputs
+ * and must match at the end of every batch, and a last run checks that a NULL input
+ * table behaves as no input. The simulation has no AI level of detail: it runs the AI
+ * every frame. The reference goes through mettreAJourIA(), which only defers culled
+ * enemies, and the enemy never leaves the screen in this game, so the test also fails
+ * if the reference ever defers an update. Run from the directory holding the game's images.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <SDL/SDL.h>
+#include "arena.h"
+#include "enemy.h"
+#include "simulation.h"
+
+#define NB_SESSIONS 2000
+#define NB_FRAMES 3000
+#define PERSO_W 40
+#define PERSO_H 60
+#define PAS_LOT 25
+#define NB_FRAMES_SANS_ENTREE 600
+
+/**
+ * @brief State of one session in the scalar reference, as held by main()'s locals.
+ */
+typedef struct
+{
+  SDL_Rect posPerso;
+  Ennemi e;
+  Coin coin1;
+  Coin coin2;
+  int health;
+  int score;
+  int level;
+  int termine;
+  Uint32 last_hit_time;
+} Partie;
+
+static Ennemi modeleLevel1, modeleLevel2;
+static const SDL_Rect ecran = {0, 0, SIM_LARGEUR, SIM_HAUTEUR};
+
+// Bot input: mostly chase the enemy or the visible coin, sometimes hug the left wall
+static int choisirDirection(Partie *p, int i, Uint32 *graine)
+{
+    int cx, cy, ax, ay;
+    Uint32 g = *graine;
+    g ^= g << 13;
+    g ^= g >> 17;
+    g ^= g << 5;
+    *graine = g;
+
+    if (i % 4 == 0 && g % 10 < 7)
+        return 0;
+    if (g % 3 == 0)
+        return (int)(g >> 8) % 5 - 1;
+
+    if (p->e.alive) {
+        cx = p->e.pos_depart.x;
+        cy = p->e.pos_depart.y;
+    } else if (p->coin1.visible) {
+        cx = p->coin1.pos.x;
+        cy = p->coin1.pos.y;
+    } else if (p->coin2.visible) {
+        cx = p->coin2.pos.x;
+        cy = p->coin2.pos.y;
+    } else {
+        return -1;
+    }
+    ax = abs(cx - p->posPerso.x);
+    ay = abs(cy - p->posPerso.y);
+    if (ax >= ay)
+        return cx > p->posPerso.x ? 1 : (cx < p->posPerso.x ? 0 : -1);
+    return cy > p->posPerso.y ? 2 : 3;
+}
+
+static void initPartie(Partie *p)
+{
+    p->posPerso.x = 10;
+    p->posPerso.y = 450;
+    // Set by the first SDL_BlitSurface of the player in main.c
+    p->posPerso.w = PERSO_W;
+    p->posPerso.h = PERSO_H;
+    p->e = modeleLevel1;
+    p->coin1.pos.x = p->coin1.pos.y = 0;
+    p->coin1.pos.w = p->coin1.pos.h = 20;
+    p->coin1.visible = 0;
+    p->coin2 = p->coin1;
+    p->health = 100;
+    p->score = 0;
+    p->level = 1;
+    p->termine = 0;
+    p->last_hit_time = 0;
+}
+
+// One frame of the main.c loop, without the drawing
+static void avancerPartie(Partie *p, int direction, Uint32 current_time, CullStats *stats)
+{
+    if (p->termine)
+        return;
+
+    if (direction == 1) p->posPerso.x += 5;
+    if (direction == 0) p->posPerso.x -= 5;
+    if (direction == 3) p->posPerso.y -= 5;
+    if (direction == 2) p->posPerso.y += 5;
+
+    if (p->posPerso.x < 0) p->posPerso.x = 0;
+    if (p->posPerso.x > 1060 - PERSO_W) p->posPerso.x = 1060 - PERSO_W;
+    if (p->posPerso.y < 0) p->posPerso.y = 0;
+    if (p->posPerso.y > 594 - PERSO_H) p->posPerso.y = 594 - PERSO_H;
+
+    if (p->e.alive)
+        mettreAJourIA(&p->e, p->posPerso, p->level, ennemiVisible(&p->e, ecran), stats);
+
+    if (p->e.alive && collisionTri(&p->e, p->posPerso)) {
+        if (current_time - p->last_hit_time >= 500) {
+            p->e.health -= 10;
+            p->health -= 5;
+            if (p->e.health <= 0) {
+                p->e.alive = 0;
+                p->score += 100;
+                if (p->level == 1) {
+                    p->coin1.pos.x = p->e.pos_depart.x;
+                    p->coin1.pos.y = p->e.pos_depart.y;
+                    p->coin1.visible = 1;
+                } else if (p->level == 2) {
+                    p->coin2.pos.x = p->e.pos_depart.x;
+                    p->coin2.pos.y = p->e.pos_depart.y;
+                    p->coin2.visible = 1;
+                }
+            }
+            if (p->health <= 0)
+                p->termine = 1;
+            p->last_hit_time = current_time;
+        }
+    }
+
+    if (p->coin1.visible && collisionTriCoin(&p->coin1, p->posPerso)) {
+        p->coin1.visible = 0;
+        p->score += 50;
+        if (p->level == 1 && !p->e.alive) {
+            p->e = modeleLevel2;
+            p->level = 2;
+        }
+    }
+
+    if (p->coin2.visible && collisionTriCoin(&p->coin2, p->posPerso)) {
+        p->coin2.visible = 0;
+        p->score += 50;
+    }
+}
+
+// Compare every field the simulation keeps with the reference
+static int comparer(Partie *p, Sessions *s, int i)
+{
+    return p->posPerso.x == s->persoX[i] && p->posPerso.y == s->persoY[i] &&
+           p->health == s->persoVie[i] &&
+           p->e.pos_depart.x == s->ennemiX[i] && p->e.pos_depart.y == s->ennemiY[i] &&
+           p->e.direction == s->ennemiDirection[i] && (int)p->e.state == s->ennemiEtat[i] &&
+           p->e.health == s->ennemiVie[i] && p->e.alive == s->ennemiVivant[i] &&
+           p->coin1.visible == s->coin1Visible[i] && p->coin2.visible == s->coin2Visible[i] &&
+           (!p->coin1.visible || (p->coin1.pos.x == s->coin1X[i] && p->coin1.pos.y == s->coin1Y[i])) &&
+           (!p->coin2.visible || (p->coin2.pos.x == s->coin2X[i] && p->coin2.pos.y == s->coin2Y[i])) &&
+           p->score == s->score[i] && p->level == s->niveau[i] && p->termine == s->termine[i];
+}
+
+// Compare every field of two sets of sessions
+static int memesSessions(Sessions *a, Sessions *b, int i)
+{
+    return a->persoX[i] == b->persoX[i] && a->persoY[i] == b->persoY[i] &&
+           a->persoVie[i] == b->persoVie[i] &&
+           a->ennemiX[i] == b->ennemiX[i] && a->ennemiY[i] == b->ennemiY[i] &&
+           a->ennemiDirection[i] == b->ennemiDirection[i] && a->ennemiEtat[i] == b->ennemiEtat[i] &&
+           a->ennemiVie[i] == b->ennemiVie[i] && a->ennemiVivant[i] == b->ennemiVivant[i] &&
+           a->coin1X[i] == b->coin1X[i] && a->coin1Y[i] == b->coin1Y[i] &&
+           a->coin1Visible[i] == b->coin1Visible[i] &&
+           a->coin2X[i] == b->coin2X[i] && a->coin2Y[i] == b->coin2Y[i] &&
+           a->coin2Visible[i] == b->coin2Visible[i] &&
+           a->score[i] == b->score[i] && a->niveau[i] == b->niveau[i] &&
+           a->termine[i] == b->termine[i] && a->temps[i] == b->temps[i] &&
+           a->dernierCoup[i] == b->dernierCoup[i];
+}
+
+int main(int argc, char *argv[])
+{
+    Arena niveau;
+    Sessions s, lot;
+    Partie *parties;
+    Uint32 *graines;
+    int *directions;
+    CullStats stats = {0, 0, 0, 0};
+    int i, k, ligne;
+    int niveau2 = 0, coin2Ramasse = 0;
+
+    if (SDL_Init(0) == -1) {
+        printf("SDL init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    // Only the fields of the enemies are needed, not their spritesheets
+    if (initArena(&niveau, 4 * 1024 * 1024) != 0)
+        return 1;
+    initEnnemi(&modeleLevel1, &niveau);
+    initEnnemiLevel2(&modeleLevel2, &niveau);
+    modeleLevel1.spritesheet = NULL;
+    modeleLevel2.spritesheet = NULL;
+    libererArena(&niveau);
+
+    parties = malloc(sizeof(Partie) * NB_SESSIONS);
+    graines = malloc(sizeof(Uint32) * NB_SESSIONS);
+    // PAS_LOT rows of inputs, one per frame of a batch
+    directions = malloc(sizeof(int) * NB_SESSIONS * PAS_LOT);
+    // Different thread counts, so the shards of the two copies differ too
+    if (parties == NULL || graines == NULL || directions == NULL ||
+        initSessions(&s, NB_SESSIONS, PERSO_W, PERSO_H, 0) != 0 ||
+        initSessions(&lot, NB_SESSIONS, PERSO_W, PERSO_H, 3) != 0) {
+        printf("FAIL: allocation\n");
+        return 1;
+    }
+    for (i = 0; i < NB_SESSIONS; i++) {
+        initPartie(&parties[i]);
+        graines[i] = 2463534242u + i * 7919u;
+    }
+
+    for (k = 0; k < NB_FRAMES; k++) {
+        ligne = k % PAS_LOT;
+        for (i = 0; i < NB_SESSIONS; i++) {
+            int coin2Avant = parties[i].coin2.visible;
+            int d = choisirDirection(&parties[i], i, &graines[i]);
+            directions[ligne * NB_SESSIONS + i] = d;
+            avancerPartie(&parties[i], d, (Uint32)k * SIM_PAS_MS, &stats);
+            if (coin2Avant && !parties[i].coin2.visible)
+                coin2Ramasse++;
+        }
+        avancerSessions(&s, directions + ligne * NB_SESSIONS, 1);
+
+        for (i = 0; i < NB_SESSIONS; i++) {
+            if (!comparer(&parties[i], &s, i)) {
+                printf("FAIL: session %d differs at frame %d (ref player %d,%d enemy %d,%d score %d; "
+                       "sim player %d,%d enemy %d,%d score %d)\n", i, k,
+                       parties[i].posPerso.x, parties[i].posPerso.y,
+                       parties[i].e.pos_depart.x, parties[i].e.pos_depart.y, parties[i].score,
+                       s.persoX[i], s.persoY[i], s.ennemiX[i], s.ennemiY[i], s.score[i]);
+                return 1;
+            }
+        }
+
+        // Replay the whole batch in one call once its last row is filled
+        if (ligne == PAS_LOT - 1) {
+            avancerSessions(&lot, directions, PAS_LOT);
+            for (i = 0; i < NB_SESSIONS; i++) {
+                if (!memesSessions(&lot, &s, i)) {
+                    printf("FAIL: session %d differs after a batch of %d frames ending at frame %d\n",
+                           i, PAS_LOT, k);
+                    return 1;
+                }
+            }
+        }
+    }
+    if (stats.iaReportees != 0) {
+        printf("FAIL: the reference deferred %d AI updates\n", stats.iaReportees);
+        return 1;
+    }
+
+    for (i = 0; i < NB_SESSIONS; i++)
+        niveau2 += parties[i].level == 2;
+    printf("sessions reaching level 2: %d, level 2 coins picked up: %d\n", niveau2, coin2Ramasse);
+    if (niveau2 == 0 || coin2Ramasse == 0) {
+        printf("FAIL: the bot did not reach level 2 and its coin\n");
+        return 1;
+    }
+
+    // No input table: every session must match a reference given no input each frame
+    libererSessions(&lot);
+    if (initSessions(&lot, NB_SESSIONS, PERSO_W, PERSO_H, 0) != 0) {
+        printf("FAIL: allocation\n");
+        return 1;
+    }
+    for (i = 0; i < NB_SESSIONS; i++)
+        initPartie(&parties[i]);
+    for (k = 0; k < NB_FRAMES_SANS_ENTREE; k++) {
+        for (i = 0; i < NB_SESSIONS; i++)
+            avancerPartie(&parties[i], -1, (Uint32)k * SIM_PAS_MS, &stats);
+        if (k % PAS_LOT != PAS_LOT - 1)
+            continue;
+        avancerSessions(&lot, NULL, PAS_LOT);
+        for (i = 0; i < NB_SESSIONS; i++) {
+            if (!comparer(&parties[i], &lot, i)) {
+                printf("FAIL: session %d differs without input at frame %d\n", i, k);
+                return 1;
+            }
+        }
+    }
+
+    printf("OK: %d sessions x %d frames identical, in single frames and in batches of %d\n",
+           NB_SESSIONS, NB_FRAMES, PAS_LOT);
+    libererSessions(&s);
+    libererSessions(&lot);
+    free(parties);
+    free(graines);
+    free(directions);
+    SDL_Quit();
+    return 0;
+}